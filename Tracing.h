@@ -0,0 +1,174 @@
+#pragma once
+#include "Utils.h"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+
+namespace tracing
+{
+    static const std::string defaultTraceFile = "SearchBoxHandler.trace.json";
+    static constexpr size_t defaultCapacity = 1 << 16;
+
+    // One recorded span. Written exactly once by the thread that closed the span,
+    // 'committed' tells the flushing thread that the slot is fully written
+    struct Event
+    {
+        const char* name{ nullptr };
+        DWORD tid{ 0 };
+        long long startUs{ 0 };
+        long long durUs{ 0 };
+        std::atomic_bool committed{ false };
+    };
+
+    // Records spans into a preallocated buffer and dumps them as Chrome trace-event
+    // JSON, which can be loaded into Perfetto or chrome://tracing
+    //
+    // Recording is lock free: every span claims its own slot with a single atomic
+    // increment, so UIA callback threads never wait for each other or for flush.
+    // When the buffer is full new spans are dropped and only counted
+    class Tracer
+    {
+    public:
+        Tracer() = default;
+
+        // allocates the buffer up front, has to be called before any span is recorded
+        void enable(size_t eventsCapacity = defaultCapacity)
+        {
+            if (enabled.load())
+                return;
+
+            events.reset(new Event[eventsCapacity]);
+            capacity = eventsCapacity;
+            origin = std::chrono::steady_clock::now();
+            enabled.store(true);
+        }
+
+        bool isEnabled() const
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        long long nowUs() const
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - origin).count();
+        }
+
+        // 'name' is stored as is, so it must be a string literal (no quotes or backslashes)
+        void record(const char* name, long long startUs, long long endUs)
+        {
+            const auto slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+            if (slot >= capacity)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            auto& ev = events[slot];
+            ev.name = name;
+            ev.tid = GetCurrentThreadId();
+            ev.startUs = startUs;
+            ev.durUs = endUs - startUs;
+            ev.committed.store(true, std::memory_order_release);
+        }
+
+        // writes all spans recorded so far, can be called while recording is in progress;
+        // spans which are not committed yet will appear in the next flush
+        bool flush(const std::string& path)
+        {
+            if (!isEnabled())
+                return false;
+
+            std::lock_guard lk(flushMx);
+
+            std::ofstream out(path, std::ios::trunc);
+            if (!out)
+            {
+                std::wcerr << "Failed to open trace file" << std::endl;
+                return false;
+            }
+
+            const auto pid = GetCurrentProcessId();
+            const auto claimed = nextSlot.load(std::memory_order_relaxed);
+            const auto recorded = claimed < capacity ? claimed : capacity;
+
+            out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+            bool first{ true };
+            for (size_t id{ 0 }; id < recorded; id++)
+            {
+                const auto& ev = events[id];
+                if (!ev.committed.load(std::memory_order_acquire))
+                    continue;
+
+                out << (first ? "\n" : ",\n")
+                    << "{\"name\":\"" << ev.name
+                    << "\",\"ph\":\"X\",\"pid\":" << pid
+                    << ",\"tid\":" << ev.tid
+                    << ",\"ts\":" << ev.startUs
+                    << ",\"dur\":" << ev.durUs << "}";
+                first = false;
+            }
+
+            out << "\n]}\n";
+
+            if (const auto lost = dropped.load(std::memory_order_relaxed); lost > 0)
+                std::wcout << "Trace buffer is full, spans dropped: " << lost << std::endl;
+
+            return out.good();
+        }
+
+    private:
+        Tracer(const Tracer&) = delete;
+        Tracer& operator=(const Tracer&) = delete;
+        Tracer(Tracer&&) = delete;
+        Tracer& operator=(Tracer&&) = delete;
+
+        std::atomic_bool enabled{ false };
+        std::unique_ptr<Event[]> events;
+        size_t capacity{ 0 };
+        std::atomic<size_t> nextSlot{ 0 };
+        std::atomic<size_t> dropped{ 0 };
+        std::chrono::steady_clock::time_point origin;
+        std::mutex flushMx;
+    };
+
+    inline Tracer& GetTracer()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    // RAII span, records [construction, destruction) interval on the current thread.
+    // Costs a single relaxed load when tracing is disabled
+    class Span
+    {
+    public:
+        explicit Span(const char* spanName)
+        {
+            if (auto& tracer = GetTracer(); tracer.isEnabled())
+            {
+                name = spanName;
+                startUs = tracer.nowUs();
+            }
+        }
+
+        ~Span()
+        {
+            if (name)
+            {
+                auto& tracer = GetTracer();
+                tracer.record(name, startUs, tracer.nowUs());
+            }
+        }
+
+    private:
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+        const char* name{ nullptr };
+        long long startUs{ 0 };
+    };
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "Utils.h"
+#include "Tracing.h"
 
 namespace uia
 {
@@ -17,6 +18,8 @@ namespace uia
 
         UIElemPtr findUrl(UIAutoPtr& uiAuto, UIElemPtr& rootElem)
         {
+            tracing::Span span("findUrl");
+
             if (!uiAuto || !rootElem)
                 return nullptr;
 
@@ -194,11 +197,16 @@ namespace uia
 
         bool HandleUrlNew(IUIAutomationElement* pSender)
         {
+            tracing::Span span("HandleUrlNew");
+
             if (!pSender)
                 return false;
 
             utils::VariantWrapper var;
-            pSender->GetCurrentPropertyValue(UIA_ValueValuePropertyId, &(var.get()));
+            {
+                tracing::Span valueSpan("GetCurrentPropertyValue");
+                pSender->GetCurrentPropertyValue(UIA_ValueValuePropertyId, &(var.get()));
+            }
             auto currUrl = utils::BstrToWstring(var.get().bstrVal);
 
             //std::wcout << "> Name: " << currUrl << std::endl;
@@ -234,7 +242,12 @@ namespace uia
             }
 
             BSTR updatedUrlValue = SysAllocString(currUrl.data());
-            if (auto h = valuePattern->SetValue(updatedUrlValue); FAILED(h))
+            HRESULT setValueRes;
+            {
+                tracing::Span setValueSpan("SetValue");
+                setValueRes = valuePattern->SetValue(updatedUrlValue);
+            }
+            if (FAILED(setValueRes))
             {
                 //std::wcerr << "Failed to Set Value: " << currUrl << std::endl;
                 SysFreeString(updatedUrlValue);
@@ -245,7 +258,10 @@ namespace uia
 
             // need to simulate Enter key pressed on a keyboard to perform a search
             // with modified URL string
-            SendInput(ARRAYSIZE(kbdInputs), kbdInputs, sizeof(INPUT));
+            {
+                tracing::Span sendInputSpan("SendInput");
+                SendInput(ARRAYSIZE(kbdInputs), kbdInputs, sizeof(INPUT));
+            }
 
             return true;
         }
@@ -302,6 +318,8 @@ namespace uia
 
         HRESULT STDMETHODCALLTYPE HandleAutomationEvent(IUIAutomationElement* pSender, EVENTID eventID)
         {
+            tracing::Span span("BrowserWindowEventHandler");
+
             switch (eventID)
             {
             case UIA_Window_WindowOpenedEventId:
@@ -343,6 +361,8 @@ namespace uia
 
     bool AddUrlHandler(UIAutoPtr& ui, UIElemPtr& urlElem, UrlEventHPtr& urlHandler)
     {
+        tracing::Span span("AddAutomationEventHandler(Url)");
+
         auto h = ui->AddAutomationEventHandler(
             UIA_Text_TextChangedEventId,
             urlElem.get(),
@@ -355,6 +375,8 @@ namespace uia
 
     bool AddBrowserWindowHandler(UIAutoPtr& ui, UIElemPtr& winElem, BrowserEventHPtr& winHandler)
     {
+        tracing::Span span("AddAutomationEventHandler(Window)");
+
         auto h = ui->AddAutomationEventHandler(
             UIA_Window_WindowOpenedEventId,
             winElem.get(),
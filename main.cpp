@@ -3,8 +3,10 @@
 #include <chrono>
 
 static const std::string stopWord("quit");
+static const std::string traceWord("trace");
+static const std::string traceFlag("--trace");
 
-void HandleUserInput(std::atomic_bool& run)
+void HandleUserInput(std::atomic_bool& run, const std::string& traceFile)
 {
     std::string input;
 
@@ -13,13 +15,23 @@ void HandleUserInput(std::atomic_bool& run)
         std::cin >> input;
         if (input == stopWord)
             run.store(false);
+        else if (input == traceWord && tracing::GetTracer().flush(traceFile))
+            std::cout << "Trace written to: " << traceFile << std::endl;
     }
 }
 
-int main()
+int main(int argc, char* argv[])
 {
     using namespace std::chrono_literals;
 
+    // optional tracing mode: "--trace [file]", spans are dumped on "trace" command and at exit
+    std::string traceFile;
+    if (argc > 1 && argv[1] == traceFlag)
+    {
+        traceFile = argc > 2 ? argv[2] : tracing::defaultTraceFile;
+        tracing::GetTracer().enable();
+    }
+
     // SyncBlock is used for synchronization between browser window opened event
     // handler and main thread launching event handlers for url manipulation
     utils::SyncBlock sBlock;
@@ -31,14 +43,17 @@ int main()
     if (!uiManager.init(sBlock))
     {
         std::wcout << "Failed to init UI Manager" << std::endl;
+        tracing::GetTracer().flush(traceFile);
         return 1;
     }
 
     std::wcout << "Print \"quit\" to stop url manipulator" << std::endl;
+    if (tracing::GetTracer().isEnabled())
+        std::wcout << "Print \"trace\" to dump recorded spans" << std::endl;
 
     // Launch separate thread to handle user input
     std::atomic_bool run(true);
-    std::thread userInputThread(HandleUserInput, std::ref(run));
+    std::thread userInputThread(HandleUserInput, std::ref(run), std::cref(traceFile));
 
     while (run.load())
     {
@@ -46,10 +61,15 @@ int main()
         // other Edit Control + event handler
         {
             std::unique_lock lock(sBlock.mx);
-            const auto status = sBlock.cv.wait_for(lock, 1000ms, [&] { return sBlock.processed; });
+            bool status;
+            {
+                tracing::Span span("WaitForBrowserWindow");
+                status = sBlock.cv.wait_for(lock, 1000ms, [&] { return sBlock.processed; });
+            }
             if (!status)
             {
                 // try to sleep for another 1 sec and then continue
+                tracing::Span span("Sleep");
                 std::this_thread::sleep_for(1000ms);
                 continue;
             }
@@ -66,6 +86,9 @@ int main()
     run.store(false);
     userInputThread.join();
 
+    if (tracing::GetTracer().flush(traceFile))
+        std::cout << "Trace written to: " << traceFile << std::endl;
+
     std::wcout << "Finished processing." << std::endl;
 
     return 0;